@@ -10,6 +10,10 @@ goog.module('grpc.Endpoint');
  * at the server.
  * 
  * An optional transport name can be requested.  Allowed values are enum Transport.Type.
+ *
+ * An optional http method can be requested.  The default is 'POST'.  With
+ * 'GET' the request is carried in the URL so the response can be cached;
+ * this is only meaningful for unary methods without side effects.
  *
   * @typedef{{
     path:(string|undefined),
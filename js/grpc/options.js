@@ -38,6 +38,12 @@ class Options {
      * @type {string}
      */
     this.path_ = opt_path || "";
+
+    /**
+     * @private
+     * @type {number}
+     */
+    this.max_get_url_length_ = Options.DEFAULT_MAX_GET_URL_LENGTH;
     
   }
 
@@ -75,7 +81,32 @@ class Options {
   setPerRpcMetadata(per_rpc_metadata) {
     this.per_rpc_metadata_ = per_rpc_metadata;
   }
+
+  /**
+   * @return {number}
+   */
+  getMaxGetUrlLength() {
+    return this.max_get_url_length_;
+  }
+
+  /**
+   * Set the longest URL a GET call may use.  Calls whose encoded request
+   * would exceed it are sent as a POST instead.  0 means unlimited.
+   *
+   * @param {number} max_get_url_length
+   */
+  setMaxGetUrlLength(max_get_url_length) {
+    this.max_get_url_length_ = max_get_url_length;
+  }
   
 }
 
+/**
+ * Default maximum URL length of a GET call.  Conservative enough for
+ * common proxies and CDNs.
+ *
+ * @const {number}
+ */
+Options.DEFAULT_MAX_GET_URL_LENGTH = 2048;
+
 exports = Options;
@@ -42,4 +42,15 @@ Transport.Type = {
     WEBSOCKET: 'websocket',
 };
 
+/**
+ * Name of the URL query parameter that carries the request of a GET call.
+ * The value is the grpc-web framed request (5-byte header plus the encoded
+ * message) as base64url (RFC 4648 section 5, '-' and '_') without '='
+ * padding.  Keeping the request in the URL lets http caches key on it.
+ *
+ * @public
+ * @const {string}
+ */
+Transport.REQUEST_QUERY_PARAM = 'grpc-web-request';
+
 exports = Transport;
\ No newline at end of file
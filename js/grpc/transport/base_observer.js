@@ -10,6 +10,7 @@ const EventHandler = goog.require('goog.events.EventHandler');
 const GrpcOptions = goog.require('grpc.Options');
 const GrpcStatus = goog.require('grpc.Status');
 const GrpcStreamRejection = goog.require('grpc.Rejection');
+const HttpGetQuery = goog.require('grpc.transport.Query');
 const HttpStatus = goog.require('goog.net.HttpStatus');
 const JspbByteSource = goog.require('jspb.ByteSource');
 const JspbMessage = goog.require('jspb.Message');
@@ -217,6 +218,17 @@ class Observer {
     return url;
   }
 
+  /**
+   * Construct the endpoint URL of a GET call.  The framed request is
+   * appended as a query parameter so that equal requests map to equal URLs.
+   * @protected
+   * @param {!ArrayBufferView} frame The framed request
+   * @return {?string} The URL to connect to, or null if it would be too long
+   */
+  getEndpointUrlWithRequest(frame) {
+    return HttpGetQuery.getRequestUrl(this.getEndpointUrl(), frame, this.options.getMaxGetUrlLength());
+  }
+
   /**
    * Relay an error.  This is a terminal event and releases the XHR/fetch.
    * @protected
@@ -11,7 +11,6 @@ const GrpcStatus = goog.require('grpc.Status');
 const JspbByteSource = goog.require('jspb.ByteSource');
 const StreamObserver = goog.require('grpc.Observer');
 const asserts = goog.require('goog.asserts');
-const base64 = goog.require('goog.crypt.base64');
 const objects = goog.require('goog.object');
 
 /**
@@ -71,7 +70,7 @@ class Observer extends BaseObserver {
       return; // superclass failed, don't continue
     }
 
-    let url = this.getEndpointUrl();
+    const url = this.getEndpointUrl();
     const controller = this.controller_ = new AbortController();
     const headers = new Headers();
 
@@ -96,18 +95,22 @@ class Observer extends BaseObserver {
       });
     }
 
-    const method = this.getEndpointMethod();
+    let method = this.getEndpointMethod();
     const body = this.frameRequest(asserts.assertObject(this.getValue()));
     const signal = controller.signal;
-    let options = { method, headers, body, signal };
 
-    if (options.method === "GET") {
-      const b64 = base64.encodeByteArray(/** @type {!Uint8Array} **/(body));
-      headers.append('x-grpc-web-request', b64);
-      options = { method, headers, signal };
+    // A GET carries the request in the URL rather than the body, which
+    // allows the browser and intermediaries to cache (and revalidate) the
+    // response.  Requests too large for a URL fall back to POST.
+    const getUrl = method === "GET" ? this.getEndpointUrlWithRequest(body) : null;
+    if (method === "GET" && !getUrl) {
+      method = "POST";
     }
+    const request = getUrl ?
+      fetch(getUrl, { method, headers, signal }) :
+      fetch(url, { method, headers, body, signal });
 
-    fetch(url, options)
+    request
       .then(res => this.handleFetchResponse(res))
       .catch(err => this.handleFetchError(err));
   }
@@ -0,0 +1,426 @@
+goog.module('grpc.transport.fetch.ObserverTest');
+goog.setTestOnly('grpc.transport.fetch.ObserverTest');
+
+const FetchObserver = goog.require('grpc.transport.fetch.Observer');
+const GoogPromise = goog.require('goog.Promise');
+const GrpcOptions = goog.require('grpc.Options');
+const JspbBinaryReader = goog.require('jspb.BinaryReader');
+const JspbBinaryWriter = goog.require('jspb.BinaryWriter');
+const JspbByteSource = goog.require('jspb.ByteSource');
+const JspbMessage = goog.require('jspb.Message');
+const PropertyReplacer = goog.require('goog.testing.PropertyReplacer');
+const StreamObserver = goog.require('grpc.Observer');
+const Transport = goog.require('grpc.Transport');
+const base64 = goog.require('goog.crypt.base64');
+const jsunit = goog.require('goog.testing.jsunit');
+const testSuite = goog.require('goog.testing.testSuite');
+
+/** @type {!PropertyReplacer} */
+const stubs = new PropertyReplacer();
+
+/** @type {!StandInServer} */
+let server;
+
+testSuite({
+
+  setUp: () => {
+    assertNotNull(jsunit);
+    server = new StandInServer();
+    stubs.set(goog.global, 'fetch', (url, init) => server.fetch(url, init));
+    // The headless test runner predates the fetch API.
+    stubs.set(goog.global, 'Headers', FakeHeaders);
+    stubs.set(goog.global, 'AbortController', FakeAbortController);
+  },
+
+  tearDown: () => {
+    stubs.reset();
+  },
+
+  testPostSendsRequestInBody: () => {
+    return call('foo', { method: 'POST' }).then(observer => {
+      assertEquals(1, server.requests.length);
+      const req = server.requests[0];
+      assertEquals('POST', req.method);
+      assertEquals('/mockService.getFoo', req.url);
+      assertNotNull(req.body);
+      assertEquals('foo', req.name);
+
+      assertEquals(1, observer.messageStack.length);
+      assertEquals('hello foo', observer.messageStack[0].name);
+      assertEquals(1, observer.isCompleted);
+      assertEquals(0, observer.errorStack.length);
+    });
+  },
+
+  testGetSendsRequestInUrl: () => {
+    return call('foo', { method: 'GET' }).then(observer => {
+      assertEquals(1, server.requests.length);
+      const req = server.requests[0];
+      assertEquals('GET', req.method);
+      assertUndefined('GET must not carry a body', req.body);
+      assertEquals('foo', req.name);
+
+      // The request is a web-safe query parameter that needs no escaping.
+      const prefix = '/mockService.getFoo?' + Transport.REQUEST_QUERY_PARAM + '=';
+      assertTrue(req.url.startsWith(prefix));
+      const value = req.url.substring(prefix.length);
+      assertEquals(value, encodeURIComponent(value));
+      assertNull(req.headers.get('x-grpc-web-request'));
+
+      assertEquals(1, observer.messageStack.length);
+      assertEquals('hello foo', observer.messageStack[0].name);
+      assertEquals(1, observer.isCompleted);
+      assertEquals(0, observer.errorStack.length);
+    });
+  },
+
+  testGetRequestEncoding: () => {
+    // Frame [0, 0, 0, 0, 8, 10, 6, 'y?hp~>'] is AAAAAAgKBnk/aHB+Pg== in
+    // standard base64; the wire format is base64url without padding.
+    return call('y?hp~>', { method: 'GET' }).then(() => {
+      const req = server.requests[0];
+      assertEquals('/mockService.getFoo?grpc-web-request=AAAAAAgKBnk_aHB-Pg', req.url);
+      assertEquals('y?hp~>', req.name);
+    });
+  },
+
+  testGetFallsBackToPostWhenUrlTooLong: () => {
+    const options = new GrpcOptions();
+    options.setMaxGetUrlLength(64);
+    return GoogPromise.all([
+      call('short', { method: 'GET' }, options),
+      call('x'.repeat(64), { method: 'GET' }, options),
+    ]).then(observers => {
+      assertEquals(2, server.requests.length);
+      assertEquals('GET', server.requests[0].method);
+
+      const req = server.requests[1];
+      assertEquals('POST', req.method);
+      assertEquals('/mockService.getFoo', req.url);
+      assertNotNull(req.body);
+      assertEquals('x'.repeat(64), req.name);
+      assertEquals(1, observers[1].isCompleted);
+    });
+  },
+
+  testGetUrlIsCacheKey: () => {
+    return GoogPromise.all([
+      call('foo', { method: 'GET' }),
+      call('foo', { method: 'GET' }),
+      call('bar', { method: 'GET' }),
+    ]).then(() => {
+      assertEquals(3, server.requests.length);
+      assertEquals(server.requests[0].url, server.requests[1].url);
+      assertNotEquals(server.requests[0].url, server.requests[2].url);
+      assertEquals('bar', server.requests[2].name);
+    });
+  },
+
+  testGetUsesEndpointUrl: () => {
+    const endpoint = { method: 'GET', host: 'https://cdn.example.com', path: 'api' };
+    return call('foo', endpoint).then(() => {
+      const req = server.requests[0];
+      assertTrue(req.url.startsWith('https://cdn.example.com/api/mockService.getFoo?'));
+      assertEquals('foo', req.name);
+    });
+  },
+
+});
+
+
+/**
+ * Make a single unary call against the stand-in server.
+ *
+ * @param {string} name The request message name field
+ * @param {!Object} endpoint
+ * @param {!GrpcOptions=} opt_options
+ * @return {!GoogPromise<!MockObserver>} Resolves once the call completes or fails.
+ */
+function call(name, endpoint, opt_options) {
+  const resolver = GoogPromise.withResolver();
+  const observer = new MockObserver(() => resolver.resolve(observer));
+  const stream = new FetchObserver(
+    opt_options || new GrpcOptions(),
+    'mockService.getFoo',
+    mockEncoder,
+    mockDecoder,
+    observer,
+    /** @type {?} */ (endpoint));
+  const message = new MockProtocolBuffer();
+  message.name = name;
+  stream.onNext(message);
+  stream.onCompleted();
+  return resolver.promise;
+}
+
+
+/**
+ * @param {!JspbMessage} message
+ * @return {!JspbByteSource}
+ */
+function mockEncoder(message) {
+  const mock = /** @type {!MockProtocolBuffer} */ (message);
+  return mock.serializeBinary();
+}
+
+
+/**
+ * @param {!JspbByteSource} bytes
+ * @return {!JspbMessage}
+ */
+function mockDecoder(bytes) {
+  return MockProtocolBuffer.fromBytes(bytes);
+}
+
+
+/**
+ * Prepend the 5-byte grpc-web message frame header.
+ *
+ * @param {!Uint8Array} data
+ * @return {!Uint8Array}
+ */
+function frame(data) {
+  const buffer = new Uint8Array(data.length + 5);
+  new DataView(buffer.buffer, 1, 4).setUint32(0, data.length, false /* big endian */);
+  buffer.set(data, 5);
+  return buffer;
+}
+
+
+/**
+ * Minimal stand-in for the fetch API Headers class.
+ */
+class FakeHeaders {
+
+  /**
+   * @param {!Array<!Array<string>>=} opt_entries
+   */
+  constructor(opt_entries) {
+    /** @private @const @type {!Map<string,string>} */
+    this.map_ = new Map();
+    (opt_entries || []).forEach(pair => this.append(pair[0], pair[1]));
+  }
+
+  /**
+   * @param {string} key
+   * @param {string} value
+   */
+  append(key, value) {
+    this.map_.set(key.toLowerCase(), value);
+  }
+
+  /**
+   * @param {string} key
+   * @return {?string}
+   */
+  get(key) {
+    const value = this.map_.get(key.toLowerCase());
+    return value === undefined ? null : value;
+  }
+
+  /**
+   * @return {!Iterator<!Array<string>>}
+   */
+  entries() {
+    return this.map_.entries();
+  }
+
+}
+
+
+/**
+ * Minimal stand-in for the fetch API AbortController class.
+ */
+class FakeAbortController {
+
+  constructor() {
+    /** @public @const */
+    this.signal = { aborted: false };
+  }
+
+  abort() {
+    this.signal.aborted = true;
+  }
+
+}
+
+
+/**
+ * Decode a base64url value without padding the way a server would: map it
+ * back to the standard alphabet and restore the padding.
+ *
+ * @param {string} value
+ * @return {!Uint8Array}
+ */
+function decodeBase64Url(value) {
+  assertFalse('no padding expected: ' + value, value.includes('='));
+  assertFalse('no standard alphabet expected: ' + value, /[+/]/.test(value));
+  const padded = value.replace(/-/g, '+').replace(/_/g, '/') +
+    '==='.substring(0, (4 - value.length % 4) % 4);
+  return base64.decodeStringToUint8Array(padded);
+}
+
+
+/**
+ * Stand-in for a grpc-web server.  It is installed as the global fetch
+ * function, decodes the request from either the body (POST) or the URL
+ * (GET), and replies with a single greeting message.
+ */
+class StandInServer {
+
+  constructor() {
+    /** @public @type {!Array<{method:string,url:string,headers:!FakeHeaders,body:*,name:string}>} */
+    this.requests = [];
+  }
+
+  /**
+   * @param {string} url
+   * @param {!Object} init
+   * @return {!Promise<?>}
+   */
+  fetch(url, init) {
+    const method = /** @type {string} */ (init['method']);
+    const body = init['body'];
+
+    let framed;
+    if (method === 'GET') {
+      const query = url.substring(url.indexOf('?') + 1);
+      const prefix = Transport.REQUEST_QUERY_PARAM + '=';
+      assertTrue(query.startsWith(prefix));
+      framed = decodeBase64Url(query.substring(prefix.length));
+    } else {
+      framed = /** @type {!Uint8Array} */ (body);
+    }
+
+    const request = MockProtocolBuffer.fromBytes(framed.subarray(5));
+    const headers = /** @type {!FakeHeaders} */ (init['headers']);
+    this.requests.push({ method: method, url: url, headers: headers, body: body, name: request.name });
+
+    const reply = new MockProtocolBuffer();
+    reply.name = 'hello ' + request.name;
+    const chunks = [frame(reply.serializeBinary())];
+
+    return Promise.resolve({
+      status: 200,
+      statusText: 'OK',
+      headers: new FakeHeaders([
+        ['content-type', 'application/grpc-web+proto'],
+        ['cache-control', 'public, max-age=3600'],
+      ]),
+      body: {
+        getReader: () => ({
+          read: () => Promise.resolve(chunks.length ?
+            { done: false, value: chunks.shift() } :
+            { done: true, value: undefined }),
+          cancel: () => { },
+        }),
+      },
+    });
+  }
+
+}
+
+
+class MockProtocolBuffer extends JspbMessage {
+
+  /**
+   * @param {!JspbByteSource} bytes
+   * @return {!MockProtocolBuffer}
+   */
+  static fromBytes(bytes) {
+    const message = new MockProtocolBuffer();
+    message.deserializeBinary(bytes);
+    return message;
+  }
+
+  constructor() {
+    super();
+    /** @public @type {string} */
+    this.name = "";
+  }
+
+  /**
+   * @param {!JspbByteSource} bytes The bytes to deserialize.
+   * @return {!JspbMessage}
+   */
+  deserializeBinary(bytes) {
+    const reader = new JspbBinaryReader(bytes);
+    while (reader.nextField()) {
+      if (reader.isEndGroup()) {
+        break;
+      }
+      const field = reader.getFieldNumber();
+      switch (field) {
+        case 1:
+          this.name = /** @type {string} */ (reader.readString());
+          break;
+        default:
+          throw new Error(`Unexpected input field: ${field}`);
+      }
+    }
+    return this;
+  }
+
+  /**
+   * @return {!Uint8Array}
+   */
+  serializeBinary() {
+    const writer = new JspbBinaryWriter();
+    writer.writeString(1, this.name);
+    return writer.getResultBuffer();
+  }
+
+}
+
+
+/**
+ * Mock observer impl that keeps a log of stuff that happened to it.
+ *
+ * @implements {StreamObserver}
+ */
+class MockObserver {
+
+  /**
+   * @param {function()} onDone Called once the call completes or fails.
+   */
+  constructor(onDone) {
+
+    /** @private @const */
+    this.onDone_ = onDone;
+
+    /** @public @type {!Array<!MockProtocolBuffer>} */
+    this.messageStack = [];
+
+    /** @public @type {!Array<!grpc.Rejection>} */
+    this.errorStack = [];
+
+    /** @public @type {number} */
+    this.isCompleted = 0;
+
+  }
+
+  /** @override */
+  onProgress(headers, status, isTrailer) {
+  }
+
+  /** @override */
+  onError(rejection) {
+    this.errorStack.push(rejection);
+    this.onDone_();
+  }
+
+  /**
+   * @override
+   * @param {!MockProtocolBuffer} value
+   */
+  onNext(value) {
+    this.messageStack.push(value);
+  }
+
+  /** @override */
+  onCompleted() {
+    this.isCompleted++;
+    this.onDone_();
+  }
+
+}
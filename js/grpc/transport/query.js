@@ -0,0 +1,49 @@
+/**
+ * @fileoverview Encoding of requests carried in the URL of a GET call.
+ *
+ */
+goog.module('grpc.transport.Query');
+
+const Transport = goog.require('grpc.Transport');
+const base64 = goog.require('goog.crypt.base64');
+
+
+/**
+ * Encode a framed request as the value of the
+ * Transport.REQUEST_QUERY_PARAM query parameter: base64url (RFC 4648
+ * section 5) without padding.
+ *
+ * The standard alphabet is produced first and then rewritten so the result
+ * does not depend on how a given closure release interprets the optional
+ * alphabet argument of encodeByteArray.
+ *
+ * @param {!ArrayBufferView} frame The framed request
+ * @return {string}
+ */
+function encodeRequest(frame) {
+  return base64.encodeByteArray(/** @type {!Uint8Array} */(frame))
+    .replace(/\+/g, '-')
+    .replace(/\//g, '_')
+    .replace(/=+$/, '');
+}
+
+/**
+ * Construct the URL of a GET call by appending the encoded request to the
+ * endpoint URL.  Returns null if the result would be longer than maxLength,
+ * in which case the caller should send the request as a POST instead.
+ *
+ * @param {string} url The endpoint URL
+ * @param {!ArrayBufferView} frame The framed request
+ * @param {number} maxLength The maximum URL length; 0 means unlimited.
+ * @return {?string}
+ */
+function getRequestUrl(url, frame, maxLength) {
+  const requestUrl = `${url}?${Transport.REQUEST_QUERY_PARAM}=${encodeRequest(frame)}`;
+  if (maxLength > 0 && requestUrl.length > maxLength) {
+    return null;
+  }
+  return requestUrl;
+}
+
+
+exports = { encodeRequest, getRequestUrl };
@@ -10,6 +10,7 @@ const EventHandler = goog.require('goog.events.EventHandler');
 const GrpcOptions = goog.require('grpc.Options');
 const GrpcStatus = goog.require('grpc.Status');
 const GrpcStreamRejection = goog.require('grpc.Rejection');
+const HttpGetQuery = goog.require('grpc.transport.Query');
 const HttpStatus = goog.require('goog.net.HttpStatus');
 const JspbByteSource = goog.require('jspb.ByteSource');
 const NetEventType = goog.require('goog.net.EventType');
@@ -232,7 +233,18 @@ class XhrObserver {
     // Get an xhr
     const xhr = this.xhr_ = this.xhrTransport_.createObject();
 
-    xhr.open(this.getEndpointMethod(), this.getEndpointUrl());
+    // A GET carries the request in the URL rather than the body, which
+    // allows the browser and intermediaries to cache (and revalidate) the
+    // response.  Requests too large for a URL fall back to POST.
+    let method = this.getEndpointMethod();
+    const body = this.frameRequest(this.value_);
+    const getUrl = method === "GET" ? this.getEndpointUrlWithRequest(body) : null;
+    if (getUrl) {
+      xhr.open(method, getUrl);
+    } else {
+      method = method === "GET" ? "POST" : method;
+      xhr.open(method, this.getEndpointUrl());
+    }
 
     xhr.responseType = "text";
     xhr.overrideMimeType("text/plain; charset=x-user-defined");
@@ -268,7 +280,7 @@ class XhrObserver {
     this.handler_.listen(xhr, NetEventType.TIMEOUT, this.handleXhrTimeout);
 
     // Send it!
-    xhr.send(this.frameRequest(this.value_));
+    xhr.send(method === "GET" ? null : body);
 
     return;
   }
@@ -311,6 +323,17 @@ class XhrObserver {
     return url;
   }
 
+  /**
+   * getEndpointUrlWithRequest returns the endpoint URL of a GET call, with
+   * the framed request appended as a query parameter.
+   * @protected
+   * @param {!ArrayBufferView} frame The framed request
+   * @return {?string} The URL to connect to, or null if it would be too long
+   */
+  getEndpointUrlWithRequest(frame) {
+    return HttpGetQuery.getRequestUrl(this.getEndpointUrl(), frame, this.options_.getMaxGetUrlLength());
+  }
+
   /**
    * Relay an error.  This is a terminal event and releases the XHR.
    * @protected
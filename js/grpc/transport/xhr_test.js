@@ -0,0 +1,252 @@
+goog.module('grpc.transport.XhrTest');
+goog.setTestOnly('grpc.transport.XhrTest');
+
+const GrpcOptions = goog.require('grpc.Options');
+const JspbBinaryReader = goog.require('jspb.BinaryReader');
+const JspbBinaryWriter = goog.require('jspb.BinaryWriter');
+const JspbByteSource = goog.require('jspb.ByteSource');
+const JspbMessage = goog.require('jspb.Message');
+const StreamObserver = goog.require('grpc.Observer');
+const Transport = goog.require('grpc.Transport');
+const Xhr = goog.require('grpc.transport.Xhr');
+const jsunit = goog.require('goog.testing.jsunit');
+const testSuite = goog.require('goog.testing.testSuite');
+
+testSuite({
+
+  setUp: () => {
+    assertNotNull(jsunit);
+  },
+
+  testPostSendsRequestInBody: () => {
+    const xhr = call(new GrpcOptions(), { method: 'POST' });
+
+    assertEquals('POST', xhr.method);
+    assertEquals('/mockService.getFoo', xhr.url);
+    assertEquals(1, xhr.sent.length);
+    assertUint8ArrayEquals(new Uint8Array([0, 0, 0, 0, 5, 10, 3, 102, 111, 111]), xhr.sent[0]);
+  },
+
+  testGetSendsRequestInUrl: () => {
+    const xhr = call(new GrpcOptions(), { method: 'GET' });
+
+    // Frame [0, 0, 0, 0, 5, 10, 3, 'foo'] as base64url without padding.
+    assertEquals('GET', xhr.method);
+    assertEquals('/mockService.getFoo?' + Transport.REQUEST_QUERY_PARAM + '=AAAAAAUKA2Zvbw', xhr.url);
+    assertEquals(1, xhr.sent.length);
+    assertNull(xhr.sent[0]);
+    assertEquals("1", xhr.requestHeaders["x-grpc-web"]);
+  },
+
+  testGetFallsBackToPostWhenUrlTooLong: () => {
+    const options = new GrpcOptions();
+    options.setMaxGetUrlLength(32);
+    const xhr = call(options, { method: 'GET' });
+
+    assertEquals('POST', xhr.method);
+    assertEquals('/mockService.getFoo', xhr.url);
+    assertEquals(1, xhr.sent.length);
+    assertUint8ArrayEquals(new Uint8Array([0, 0, 0, 0, 5, 10, 3, 102, 111, 111]), xhr.sent[0]);
+  },
+
+});
+
+
+/**
+ * Make a single unary call through the xhr transport and return the
+ * request it produced.
+ *
+ * @param {!GrpcOptions} options
+ * @param {!Object} endpoint
+ * @return {!FakeXmlHttpRequest}
+ */
+function call(options, endpoint) {
+  const xhr = new FakeXmlHttpRequest();
+  const input = new FakeXhr(options, xhr).call(
+    'mockService.getFoo',
+    mockEncoder,
+    mockDecoder,
+    new MockObserver(),
+    /** @type {?} */ (endpoint));
+  input.onNext(new MockProtocolBuffer());
+  input.onCompleted();
+  return xhr;
+}
+
+
+/**
+ * @param {*} a
+ * @param {*} b
+ */
+function assertUint8ArrayEquals(a, b) {
+  assertNotNull(a);
+  assertNotNull(b);
+  const ua = /** @type {!Uint8Array} */ (a);
+  const ub = /** @type {!Uint8Array} */ (b);
+  assertEquals('Buffer lengths should match', ua.byteLength, ub.byteLength);
+  for (let i = 0; i < ua.length; i++) {
+    assertEquals('Should match at position ' + i, ua[i], ub[i]);
+  }
+}
+
+
+/**
+ * @param {!JspbMessage} message
+ * @return {!JspbByteSource}
+ */
+function mockEncoder(message) {
+  const mock = /** @type {!MockProtocolBuffer} */ (message);
+  return mock.serializeBinary();
+}
+
+
+/**
+ * @param {!JspbByteSource} bytes
+ * @return {!JspbMessage}
+ */
+function mockDecoder(bytes) {
+  const message = new MockProtocolBuffer();
+  const reader = new JspbBinaryReader(bytes);
+  while (reader.nextField()) {
+    if (reader.getFieldNumber() === 1) {
+      message.name = /** @type {string} */ (reader.readString());
+    } else {
+      reader.skipField();
+    }
+  }
+  return message;
+}
+
+
+class MockProtocolBuffer extends JspbMessage {
+
+  constructor() {
+    super();
+    /** @public @type {string} */
+    this.name = "foo";
+  }
+
+  /**
+   * @return {!Uint8Array}
+   */
+  serializeBinary() {
+    const writer = new JspbBinaryWriter();
+    writer.writeString(1, this.name);
+    return writer.getResultBuffer();
+  }
+
+}
+
+
+/**
+ * Recording stand-in for an XMLHttpRequest.  It never responds; tests only
+ * inspect what the observer sent.
+ */
+class FakeXmlHttpRequest {
+
+  constructor() {
+    /** @public @type {?string} */
+    this.method = null;
+
+    /** @public @type {?string} */
+    this.url = null;
+
+    /** @public @type {!Object<string,string>} */
+    this.requestHeaders = {};
+
+    /** @public @type {!Array<*>} */
+    this.sent = [];
+
+    /** @public @type {string} */
+    this.responseType = "";
+  }
+
+  /**
+   * @param {string} method
+   * @param {string} url
+   */
+  open(method, url) {
+    this.method = method;
+    this.url = url;
+  }
+
+  /**
+   * @param {string} mimeType
+   */
+  overrideMimeType(mimeType) {
+  }
+
+  /**
+   * @param {string} key
+   * @param {string} value
+   */
+  setRequestHeader(key, value) {
+    this.requestHeaders[key] = value;
+  }
+
+  /**
+   * @param {*} body
+   */
+  send(body) {
+    this.sent.push(body);
+  }
+
+  addEventListener() {
+  }
+
+  removeEventListener() {
+  }
+
+}
+
+
+/**
+ * Xhr transport that hands out a single FakeXmlHttpRequest.
+ */
+class FakeXhr extends Xhr {
+
+  /**
+   * @param {!GrpcOptions} options
+   * @param {!FakeXmlHttpRequest} xhr
+   */
+  constructor(options, xhr) {
+    super(options);
+
+    /** @public @const @type {!FakeXmlHttpRequest} */
+    this.xhr = xhr;
+  }
+
+  /**
+   * @override
+   */
+  createObject() {
+    return /** @type {!XMLHttpRequest} */ (/** @type {?} */ (this.xhr));
+  }
+
+}
+
+
+/**
+ * Observer that ignores everything; these tests only look at the request.
+ *
+ * @implements {StreamObserver}
+ */
+class MockObserver {
+
+  /** @override */
+  onProgress(headers, status, isTrailer) {
+  }
+
+  /** @override */
+  onError(rejection) {
+  }
+
+  /** @override */
+  onNext(value) {
+  }
+
+  /** @override */
+  onCompleted() {
+  }
+
+}
@@ -0,0 +1,47 @@
+#!/bin/bash
+#
+# Runs protoc-gen-grpc-js over testdata/library.proto and compares the
+# output with the checked-in golden files.
+#
+# usage: golden_test.sh <protoc> <protoc-gen-grpc-js> <testdata dir>
+
+set -euo pipefail
+
+PROTOC="$1"
+PLUGIN="$2"
+TESTDATA="$3"
+OUT="$(mktemp -d)"
+trap 'rm -rf "$OUT"' EXIT
+
+run() {
+  local opt="$1" dir="$2"
+  mkdir -p "$dir"
+  "$PROTOC" \
+    --plugin=protoc-gen-grpc-js="$PLUGIN" \
+    --grpc-js_out="$opt$dir" \
+    -I "$TESTDATA" \
+    "$TESTDATA/library.proto"
+}
+
+# Without options the output must not change.
+run "" "$OUT/default"
+diff -u "$TESTDATA/library.grpc.js" "$OUT/default/library.grpc.js"
+
+# With http_get only the NO_SIDE_EFFECTS method switches to GET.
+run "http_get:" "$OUT/http_get"
+diff -u "$TESTDATA/library_http_get.grpc.js" "$OUT/http_get/library.grpc.js"
+
+run "http_get=true:" "$OUT/http_get_true"
+diff -u "$TESTDATA/library_http_get.grpc.js" "$OUT/http_get_true/library.grpc.js"
+
+run "http_get=false:" "$OUT/http_get_false"
+diff -u "$TESTDATA/library.grpc.js" "$OUT/http_get_false/library.grpc.js"
+
+# Unknown values are rejected.
+if run "http_get=bogus:" "$OUT/bogus" 2>"$OUT/bogus.err"; then
+  echo "expected http_get=bogus to be rejected" >&2
+  exit 1
+fi
+grep -q "invalid http_get value: bogus" "$OUT/bogus.err"
+
+echo "PASS"
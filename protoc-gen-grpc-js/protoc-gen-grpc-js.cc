@@ -19,6 +19,7 @@
 #include <google/protobuf/compiler/code_generator.h>
 #include <google/protobuf/compiler/plugin.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/io/printer.h>
 #include <google/protobuf/io/zero_copy_stream.h>
 #include <algorithm>
@@ -28,6 +29,7 @@ using google::protobuf::Descriptor;
 using google::protobuf::FieldDescriptor;
 using google::protobuf::FileDescriptor;
 using google::protobuf::MethodDescriptor;
+using google::protobuf::MethodOptions;
 using google::protobuf::ServiceDescriptor;
 using google::protobuf::compiler::CodeGenerator;
 using google::protobuf::compiler::GeneratorContext;
@@ -237,12 +239,32 @@ namespace grpc
                     "}\n\n");
             }
 
-            void PrintUnaryCall(Printer *printer, std::map<string, string> vars)
+            // Returns true if the method should be called with an HTTP GET.
+            // Only unary methods that declare idempotency_level =
+            // NO_SIDE_EFFECTS opt in, and only when the generator is run with
+            // the http_get option.
+            bool IsHttpGetMethod(const MethodDescriptor *method, bool http_get)
+            {
+                return http_get &&
+                       !method->client_streaming() &&
+                       !method->server_streaming() &&
+                       method->options().idempotency_level() == MethodOptions::NO_SIDE_EFFECTS;
+            }
+
+            void PrintUnaryCall(Printer *printer, std::map<string, string> vars, bool http_get)
             {
                 printer->Print(
                     vars,
                     "/**\n"
-                    " * Unary observation of $package$.$service_name$/$method_name$.\n"
+                    " * Unary observation of $package$.$service_name$/$method_name$.\n");
+                if (http_get)
+                {
+                    printer->Print(
+                        " *\n"
+                        " * Sent as a cacheable HTTP GET unless opt_endpoint overrides the method.\n");
+                }
+                printer->Print(
+                    vars,
                     " *\n"
                     " * @param {!Observer<!$out$>} observer\n"
                     " * @param {!$in$} request\n"
@@ -252,9 +274,19 @@ namespace grpc
                     " */\n"
                     " $js_method_name$Observation(observer, request, opt_headers, opt_endpoint) {\n");
                 printer->Indent();
+                if (http_get)
+                {
+                    printer->Print(
+                        "const endpoint = /** @type {!GrpcEndpoint} */ (Object.assign({ method: 'GET' }, opt_endpoint || {}));\n");
+                    vars["endpoint"] = "endpoint";
+                }
+                else
+                {
+                    vars["endpoint"] = "opt_endpoint";
+                }
                 printer->Print(
                     vars,
-                    "const input = this.api_.getTransport(opt_endpoint).call(\n");
+                    "const input = this.api_.getTransport($endpoint$).call(\n");
                 printer->Indent();
                 printer->Print(
                     vars,
@@ -262,7 +294,7 @@ namespace grpc
                     "/** @type {!function(!$in$):!jspb.ByteSource} */ (m => m.serializeBinary()),\n"
                     "$out$.deserializeBinary,\n"
                     "observer,\n"
-                    "opt_endpoint);\n");
+                    "$endpoint$);\n");
                 printer->Outdent();
                 printer->Print(
                     vars,
@@ -516,6 +548,7 @@ namespace grpc
                     ParseGeneratorParameter(parameter, &options);
 
                     string file_name;
+                    bool http_get = false;
 
                     for (size_t i = 0; i < options.size(); ++i)
                     {
@@ -523,6 +556,18 @@ namespace grpc
                         {
                             file_name = options[i].second;
                         }
+                        else if (options[i].first == "http_get")
+                        {
+                            if (options[i].second.empty() || options[i].second == "true")
+                            {
+                                http_get = true;
+                            }
+                            else if (options[i].second != "false")
+                            {
+                                *error = "invalid http_get value: " + options[i].second;
+                                return false;
+                            }
+                        }
                         else
                         {
                             *error = "unsupported options: " + options[i].first;
@@ -603,7 +648,7 @@ namespace grpc
                                 }
                                 else
                                 {
-                                    PrintUnaryCall(&printer, vars);
+                                    PrintUnaryCall(&printer, vars, IsHttpGetMethod(method, http_get));
                                 }
                             }
                         }
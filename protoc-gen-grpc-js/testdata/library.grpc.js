@@ -0,0 +1,143 @@
+/**
+ * @fileoverview gRPC.js generated client stub for example.library
+ * @enhanceable
+ * @public
+ * @suppress {extraRequire}
+ */
+
+// GENERATED CODE -- DO NOT EDIT!
+
+
+goog.module('proto.example.library.LibraryClient');
+
+const GrpcApi = goog.require('grpc.Api');
+const GrpcEndpoint = goog.require('grpc.Endpoint');
+const GrpcOptions = goog.require('grpc.Options');
+const GrpcRejection = goog.require('grpc.Rejection');
+const GrpcStatus = goog.require('grpc.Status');
+const GoogPromise = goog.require('goog.Promise');
+const Observer = goog.require('grpc.Observer');
+const Transport = goog.require('grpc.Transport');
+const UnaryCallObserver = goog.require('grpc.stream.observer.UnaryCallObserver');
+
+const StreamingCallObserver = goog.require('grpc.stream.observer.StreamingCallObserver');
+
+const ExampleLibraryBook = goog.require('proto.example.library.Book');
+const ExampleLibraryGetBookRequest = goog.require('proto.example.library.GetBookRequest');
+
+
+
+/**
+ * client class for service Library
+ */
+class Library {
+
+  /**
+   * @param {!GrpcApi} api
+   */
+  constructor(api) {
+    /** @private @const @type {!GrpcApi} */
+    this.api_ = api;
+  }
+
+  /**
+   * Unary observation of example.library.Library/GetBook.
+   *
+   * @param {!Observer<!ExampleLibraryBook>} observer
+   * @param {!ExampleLibraryGetBookRequest} request
+   * @param {?Object<string,string>=} opt_headers
+   * @param {?GrpcEndpoint=} opt_endpoint
+   * @suppress {reportUnknownTypes}
+   */
+   getBookObservation(observer, request, opt_headers, opt_endpoint) {
+    const input = this.api_.getTransport(opt_endpoint).call(
+      'example.library.Library/GetBook',
+      /** @type {!function(!ExampleLibraryGetBookRequest):!jspb.ByteSource} */ (m => m.serializeBinary()),
+      ExampleLibraryBook.deserializeBinary,
+      observer,
+      opt_endpoint);
+    if (opt_headers) { input.onProgress(opt_headers, GrpcStatus.OK); }
+    input.onNext(request);
+    input.onCompleted();
+  }
+
+  /**
+   * Library.getBook method (as a promise).
+   *
+   * @param {!ExampleLibraryGetBookRequest} request
+   * @param {?Object<string,string>=} opt_headers
+   * @param {?GrpcEndpoint=} opt_endpoint
+   * @return {!GoogPromise<!ExampleLibraryBook,!GrpcRejection>}
+   */
+  getBook(request, opt_headers, opt_endpoint) {
+    /** @type{!goog.promise.Resolver<!ExampleLibraryBook>} */
+    const resolver = GoogPromise.withResolver();
+    const observer = new UnaryCallObserver(resolver);
+    this.getBookObservation(observer, request, opt_headers, opt_endpoint);
+    return resolver.promise;
+  }
+
+  /**
+   * Unary observation of example.library.Library/UpdateBook.
+   *
+   * @param {!Observer<!ExampleLibraryBook>} observer
+   * @param {!ExampleLibraryBook} request
+   * @param {?Object<string,string>=} opt_headers
+   * @param {?GrpcEndpoint=} opt_endpoint
+   * @suppress {reportUnknownTypes}
+   */
+   updateBookObservation(observer, request, opt_headers, opt_endpoint) {
+    const input = this.api_.getTransport(opt_endpoint).call(
+      'example.library.Library/UpdateBook',
+      /** @type {!function(!ExampleLibraryBook):!jspb.ByteSource} */ (m => m.serializeBinary()),
+      ExampleLibraryBook.deserializeBinary,
+      observer,
+      opt_endpoint);
+    if (opt_headers) { input.onProgress(opt_headers, GrpcStatus.OK); }
+    input.onNext(request);
+    input.onCompleted();
+  }
+
+  /**
+   * Library.updateBook method (as a promise).
+   *
+   * @param {!ExampleLibraryBook} request
+   * @param {?Object<string,string>=} opt_headers
+   * @param {?GrpcEndpoint=} opt_endpoint
+   * @return {!GoogPromise<!ExampleLibraryBook,!GrpcRejection>}
+   */
+  updateBook(request, opt_headers, opt_endpoint) {
+    /** @type{!goog.promise.Resolver<!ExampleLibraryBook>} */
+    const resolver = GoogPromise.withResolver();
+    const observer = new UnaryCallObserver(resolver);
+    this.updateBookObservation(observer, request, opt_headers, opt_endpoint);
+    return resolver.promise;
+  }
+
+} // service class
+
+/**
+ * api class for service implementations
+ */
+class LibraryClient extends GrpcApi {
+
+  /**
+   * @param {?GrpcOptions=} opt_options
+   * @param {?Transport=} opt_transport
+   */
+  constructor(opt_options, opt_transport) {
+    super(opt_options, opt_transport);
+    /** @const @private @type {!Library} */
+    this.Library_ = new Library(this);
+  } // constructor
+
+  /**
+   * @return {!Library}
+   */
+  getLibrary() {
+    return this.Library_;
+  }
+}
+
+exports = LibraryClient;
+